@@ -0,0 +1,89 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Declarations shared by the benchmark translation units.
+ *
+ * The functions of text_menu_for_user.c are all static, so every benchmark
+ * translation unit includes text_menu_for_user.c through
+ * text_menu_for_user_instrumented.h. That header redirects stdin, stdout,
+ * exit() and the memory allocation functions of text_menu_for_user.c to the
+ * hooks declared here.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <setjmp.h>
+
+#define BENCH_PASTE_2(a, b) a ## b
+#define BENCH_PASTE(a, b) BENCH_PASTE_2(a, b)
+
+// Menu sizes for which print_menu() is benchmarked. The Makefile reads this
+// list to build bench/print_menu.c once for every size, so keep the list on
+// this one line.
+#define BENCH_FOR_EACH_MENU_SIZE(X) X(5) X(25) X(100) X(500)
+
+struct menu_item;
+
+// In-memory input of a benchmark. It is read directly by bench_getchar(), so
+// that the benchmarks time text_menu_for_user.c and not a stdio stream.
+struct bench_input
+{
+    const char *buf;
+    size_t len;
+    size_t pos; // index of the next character to read
+};
+
+// Input that text_menu_for_user.c reads (instead of stdin).
+extern struct bench_input *bench_input;
+
+// Stream to which text_menu_for_user.c writes its output (instead of stdout).
+extern FILE *bench_output;
+
+// If not NULL then bench_exit() jumps here instead of exiting the program.
+extern jmp_buf *bench_exit_env;
+
+// Status with which text_menu_for_user.c last called exit().
+extern int bench_exit_status;
+
+// Number of allocations (and the total bytes requested) made by
+// text_menu_for_user.c since these counters were last reset to zero.
+extern long long bench_alloc_count;
+extern long long bench_alloc_bytes;
+
+// The first allocation made by text_menu_for_user.c since this was last set
+// to NULL (NULL again once that allocation is freed).
+extern void *bench_first_alloc;
+
+int bench_getchar(void);
+_Noreturn void bench_exit(int status);
+void *bench_malloc(size_t size);
+void *bench_calloc(size_t nmemb, size_t size);
+void *bench_realloc(void *ptr, size_t size);
+void bench_free(void *ptr);
+
+// Defined in print_menu.c, once for every menu size.
+#define BENCH_DECLARE_MENU_SIZE(n)                                           \
+    struct menu_item *BENCH_PASTE(bench_create_menu_, n)(void);              \
+    void BENCH_PASTE(bench_print_menu_, n)(struct menu_item *mis_arr);
+
+BENCH_FOR_EACH_MENU_SIZE(BENCH_DECLARE_MENU_SIZE)
+
+#endif // BENCH_H
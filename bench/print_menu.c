@@ -0,0 +1,74 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * print_menu() prints 'TOTAL_NUMBER_OF_MENU_ITEMS' menu items and this is a
+ * compile time constant. So, this file is compiled once for every menu size
+ * that is benchmarked, each time with a different
+ * -DTOTAL_NUMBER_OF_MENU_ITEMS=<n>, and it defines bench_create_menu_<n>()
+ * and bench_print_menu_<n>().
+ */
+
+#ifndef TOTAL_NUMBER_OF_MENU_ITEMS
+#error "Compile this file with -DTOTAL_NUMBER_OF_MENU_ITEMS=<n>"
+#endif
+
+#define BENCH_MAIN_NAME \
+        BENCH_PASTE(text_menu_for_user_main_, TOTAL_NUMBER_OF_MENU_ITEMS)
+
+#include "text_menu_for_user_instrumented.h"
+
+/*
+ * Returns a menu of 'TOTAL_NUMBER_OF_MENU_ITEMS' items. The first 5 items are
+ * the ones created by create_menu() and the rest of the items have strings of
+ * similar length.
+ */
+struct menu_item *BENCH_PASTE(bench_create_menu_,
+                              TOTAL_NUMBER_OF_MENU_ITEMS)(void)
+{
+
+    struct menu_item *mis_arr = NULL;
+    int i = 0;
+
+    mis_arr = calloc(TOTAL_NUMBER_OF_MENU_ITEMS, sizeof(*mis_arr));
+
+    if (mis_arr == NULL) {
+        fprintf(stderr, "\n\nError: %s(): No memory available. Exiting..\n\n",
+                __FUNCTION__);
+        exit(1);
+    }
+
+    create_menu(mis_arr);
+
+    for (i = 5; i < TOTAL_NUMBER_OF_MENU_ITEMS; i++) {
+        snprintf(mis_arr[i].menu_item_string, MENU_ITEM_STRING_SIZE,
+                 "Additional menu item number %d", i + 1);
+        mis_arr[i].arg = NULL;
+        mis_arr[i].func = show_saved_number;
+    }
+
+    return mis_arr;
+
+} // end of function bench_create_menu_<n>()
+
+void BENCH_PASTE(bench_print_menu_,
+                 TOTAL_NUMBER_OF_MENU_ITEMS)(struct menu_item *mis_arr)
+{
+
+    print_menu(mis_arr);
+
+    return;
+
+} // end of function bench_print_menu_<n>()
@@ -0,0 +1,899 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * ==== README ====
+ *
+ * This program benchmarks the functions of text_menu_for_user.c, first in
+ * isolation and then end to end (full iterations of the menu loop). All input
+ * is read from in-memory buffers and all output is written to /dev/null, so
+ * no terminal is needed.
+ *
+ * The following benchmark groups are run:
+ *
+ *      ** get_input - get_input_from_stdin_and_discard_extra_characters() on
+ *         synthetic input lines of different lengths.
+ *
+ *      ** is_str_a_number - is_str_a_number() followed by atoi() (like in
+ *         get_numeric_input_from_user()).
+ *
+ *      ** print_menu - print_menu() for several menu sizes.
+ *
+ *      ** func_dispatch - calling every menu item's 'func'.
+ *
+ *      ** menu_loop - iterations of the loop in
+ *         create_and_display_menu_and_process_user_input().
+ *
+ * For every benchmark, ns/op, ops/sec, input and output throughput and
+ * allocations per op are printed and also written as JSON to the output file
+ * (default: bench_results.json) so that runs can be compared over time.
+ *
+ * Usage: text_menu_for_user_bench [--filter <substring>] [--min-time-ms <ms>]
+ *                                 [--out <file>]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+#include <errno.h>
+
+#include "text_menu_for_user_instrumented.h"
+
+#define BENCH_DEFAULT_OUT_FILE "bench_results.json"
+
+#define BENCH_DEFAULT_MIN_TIME_MS 200
+
+#define BENCH_MAX_MIN_TIME_MS 600000 // 10 minutes
+
+// Each benchmark is timed this many times and the median is reported.
+#define BENCH_REPETITIONS 5
+
+#define BENCH_NAME_SIZE 64
+
+#define BENCH_MAX_BENCHMARKS 64
+
+// Number of input lines in one batch of a get_input benchmark.
+#define BENCH_LINES_PER_BATCH 256
+
+// Number of menu loop iterations in one batch of a menu_loop benchmark.
+#define BENCH_LOOP_ITERATIONS_PER_BATCH 64
+
+// Input that makes the menu loop call exit_program().
+#define BENCH_LOOP_EXIT_INPUT "5\ny\n"
+
+struct bench_input *bench_input = NULL;
+FILE *bench_output = NULL;
+jmp_buf *bench_exit_env = NULL;
+int bench_exit_status = 0;
+long long bench_alloc_count = 0;
+long long bench_alloc_bytes = 0;
+void *bench_first_alloc = NULL;
+
+// Results are folded into this so that the compiler can't remove the work.
+static volatile long bench_sink = 0;
+
+struct benchmark
+{
+    char name[BENCH_NAME_SIZE];
+
+    // Number of ops done by one call to run_batch().
+    long long ops_per_batch;
+
+    // Bytes of input consumed by one op (0 if the op consumes no input).
+    double input_bytes_per_op;
+
+    void *ctx;
+    void (*run_batch)(void *ctx);
+};
+
+struct bench_result
+{
+    long long ops;
+    double ns_per_op;
+    double ops_per_sec;
+    double output_bytes_per_op;
+    double allocs_per_op;
+    double alloc_bytes_per_op;
+};
+
+// Context of get_input benchmarks.
+struct input_ctx
+{
+    struct bench_input *input;
+    int size;
+    char str[MAX_STR_SIZE_ALLOWED];
+};
+
+// Context of is_str_a_number benchmarks.
+struct number_ctx
+{
+    char *str;
+    int call_atoi;
+};
+
+// Context of print_menu benchmarks.
+struct print_menu_ctx
+{
+    struct menu_item *mis_arr;
+    void (*print)(struct menu_item *mis_arr);
+};
+
+// Context of func_dispatch benchmarks.
+struct dispatch_ctx
+{
+    struct menu_item *mis_arr;
+    int index;
+
+    // input for functions that read from stdin (NULL if none)
+    struct bench_input *input;
+
+    // if TM_TRUE then a number is saved before every call
+    int save_number;
+};
+
+// Context of menu_loop benchmarks.
+struct loop_ctx
+{
+    struct bench_input *input;
+};
+
+static struct benchmark benchmarks[BENCH_MAX_BENCHMARKS];
+static int num_benchmarks = 0;
+
+int bench_getchar(void)
+{
+
+    // The benchmark inputs never end in the middle of a read, so reaching the
+    // end means that some benchmark input is wrong. Without this check the menu
+    // loop would keep asking for a valid option forever.
+    if (bench_input->pos == bench_input->len) {
+        fprintf(stderr, "\n\nError: %s(): Benchmark input exhausted. Some BUG"
+                " in this benchmark. Exiting..\n\n", __FUNCTION__);
+        exit(1);
+    }
+
+    bench_input->pos = bench_input->pos + 1;
+
+    return (unsigned char)(bench_input->buf[bench_input->pos - 1]);
+
+} // end of function bench_getchar()
+
+_Noreturn void bench_exit(int status)
+{
+
+    bench_exit_status = status;
+
+    if (bench_exit_env != NULL) {
+        longjmp(*bench_exit_env, 1);
+    }
+
+    exit(status);
+
+} // end of function bench_exit()
+
+void *bench_malloc(size_t size)
+{
+
+    void *ptr = NULL;
+
+    bench_alloc_count = bench_alloc_count + 1;
+    bench_alloc_bytes = bench_alloc_bytes + (long long)(size);
+
+    ptr = malloc(size);
+
+    if (bench_first_alloc == NULL) {
+        bench_first_alloc = ptr;
+    }
+
+    return ptr;
+
+} // end of function bench_malloc()
+
+void *bench_calloc(size_t nmemb, size_t size)
+{
+
+    void *ptr = NULL;
+
+    bench_alloc_count = bench_alloc_count + 1;
+    bench_alloc_bytes = bench_alloc_bytes + (long long)(nmemb * size);
+
+    ptr = calloc(nmemb, size);
+
+    if (bench_first_alloc == NULL) {
+        bench_first_alloc = ptr;
+    }
+
+    return ptr;
+
+} // end of function bench_calloc()
+
+void *bench_realloc(void *ptr, size_t size)
+{
+
+    void *new_ptr = NULL;
+
+    bench_alloc_count = bench_alloc_count + 1;
+    bench_alloc_bytes = bench_alloc_bytes + (long long)(size);
+
+    new_ptr = realloc(ptr, size);
+
+    if ((bench_first_alloc == NULL) ||
+        ((ptr == bench_first_alloc) && (new_ptr != NULL))) {
+        bench_first_alloc = new_ptr;
+    }
+
+    return new_ptr;
+
+} // end of function bench_realloc()
+
+void bench_free(void *ptr)
+{
+
+    if (ptr == bench_first_alloc) {
+        bench_first_alloc = NULL;
+    }
+
+    free(ptr);
+
+    return;
+
+} // end of function bench_free()
+
+static long long get_time_ns(void)
+{
+
+    struct timespec ts = {0};
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((long long)(ts.tv_sec) * 1000000000LL) + ts.tv_nsec;
+
+} // end of function get_time_ns()
+
+static void *xcalloc(size_t nmemb, size_t size)
+{
+
+    void *ptr = calloc(nmemb, size);
+
+    if (ptr == NULL) {
+        fprintf(stderr, "\n\nError: %s(): No memory available. Exiting..\n\n",
+                __FUNCTION__);
+        exit(1);
+    }
+
+    return ptr;
+
+} // end of function xcalloc()
+
+/*
+ * create_input():
+ *
+ *      Returns an in-memory input that has 'str' repeated 'count' times
+ *      followed by 'suffix' ('suffix' can be NULL). The input is never freed
+ *      because it is used until this program exits.
+ */
+static struct bench_input *create_input(const char *str, int count,
+                                        const char *suffix)
+{
+
+    size_t str_len = strlen(str);
+    size_t suffix_len = (suffix == NULL) ? 0 : strlen(suffix);
+    size_t len = (str_len * (size_t)(count)) + suffix_len;
+    struct bench_input *input = NULL;
+    char *buf = NULL;
+    int i = 0;
+
+    buf = xcalloc(len + 1, 1);
+
+    for (i = 0; i < count; i++) {
+        memcpy(buf + (str_len * (size_t)(i)), str, str_len);
+    }
+
+    if (suffix != NULL) {
+        memcpy(buf + (str_len * (size_t)(count)), suffix, suffix_len);
+    }
+
+    input = xcalloc(1, sizeof(*input));
+    input->buf = buf;
+    input->len = len;
+    input->pos = 0;
+
+    return input;
+
+} // end of function create_input()
+
+static void add_benchmark(const char *name, long long ops_per_batch,
+                          double input_bytes_per_op, void *ctx,
+                          void (*run_batch)(void *ctx))
+{
+
+    struct benchmark *b = NULL;
+
+    if (num_benchmarks == BENCH_MAX_BENCHMARKS) {
+        fprintf(stderr, "\n\nError: %s(): Too many benchmarks, increase"
+                " BENCH_MAX_BENCHMARKS. Exiting..\n\n", __FUNCTION__);
+        exit(1);
+    }
+
+    b = &benchmarks[num_benchmarks];
+    num_benchmarks = num_benchmarks + 1;
+
+    snprintf(b->name, BENCH_NAME_SIZE, "%s", name);
+    b->ops_per_batch = ops_per_batch;
+    b->input_bytes_per_op = input_bytes_per_op;
+    b->ctx = ctx;
+    b->run_batch = run_batch;
+
+    return;
+
+} // end of function add_benchmark()
+
+static void run_input_batch(void *ctx)
+{
+
+    struct input_ctx *ic = ctx;
+    char *retval = NULL;
+    int i = 0;
+
+    ic->input->pos = 0;
+    bench_input = ic->input;
+
+    for (i = 0; i < BENCH_LINES_PER_BATCH; i++) {
+        retval = get_input_from_stdin_and_discard_extra_characters(ic->str,
+                                                                   ic->size);
+        bench_sink = bench_sink + retval[0];
+    }
+
+    return;
+
+} // end of function run_input_batch()
+
+static void add_input_benchmark(const char *name, int line_len, int size)
+{
+
+    struct input_ctx *ic = xcalloc(1, sizeof(*ic));
+    char *line = xcalloc((size_t)(line_len) + 2, 1);
+    int i = 0;
+
+    // digits so that the line looks like user input for a menu option
+    for (i = 0; i < line_len; i++) {
+        line[i] = (char)('0' + (i % 10));
+    }
+    line[line_len] = '\n';
+
+    ic->input = create_input(line, BENCH_LINES_PER_BATCH, NULL);
+    ic->size = size;
+
+    add_benchmark(name, BENCH_LINES_PER_BATCH, line_len + 1, ic,
+                  run_input_batch);
+
+    free(line);
+
+    return;
+
+} // end of function add_input_benchmark()
+
+static void run_number_batch(void *ctx)
+{
+
+    struct number_ctx *nc = ctx;
+    const char *volatile str = nc->str;
+    int i = 0;
+
+    for (i = 0; i < BENCH_LINES_PER_BATCH; i++) {
+        if (is_str_a_number(str) != STR_NUM_TRUE) {
+            bench_sink = bench_sink + 1;
+            continue;
+        }
+        if (nc->call_atoi == TM_TRUE) {
+            bench_sink = bench_sink + atoi(str);
+        }
+    }
+
+    return;
+
+} // end of function run_number_batch()
+
+static void add_number_benchmark(const char *name, const char *str,
+                                 int call_atoi)
+{
+
+    struct number_ctx *nc = xcalloc(1, sizeof(*nc));
+
+    nc->str = xcalloc(strlen(str) + 1, 1);
+    memcpy(nc->str, str, strlen(str));
+    nc->call_atoi = call_atoi;
+
+    add_benchmark(name, BENCH_LINES_PER_BATCH, (double)(strlen(str) + 1), nc,
+                  run_number_batch);
+
+    return;
+
+} // end of function add_number_benchmark()
+
+static void run_print_menu_batch(void *ctx)
+{
+
+    struct print_menu_ctx *pc = ctx;
+
+    pc->print(pc->mis_arr);
+
+    return;
+
+} // end of function run_print_menu_batch()
+
+static void add_print_menu_benchmark(int num_items,
+                                     struct menu_item *(*create)(void),
+                                     void (*print)(struct menu_item *mis_arr))
+{
+
+    struct print_menu_ctx *pc = xcalloc(1, sizeof(*pc));
+    char name[BENCH_NAME_SIZE] = {0};
+
+    pc->mis_arr = create();
+    pc->print = print;
+
+    snprintf(name, BENCH_NAME_SIZE, "print_menu/%d_items", num_items);
+
+    add_benchmark(name, 1, 0, pc, run_print_menu_batch);
+
+    return;
+
+} // end of function add_print_menu_benchmark()
+
+static void call_menu_item_func(struct menu_item *mis_arr, int index)
+{
+
+    jmp_buf env;
+
+    // exit_program() calls exit(), bench_exit() jumps back here
+    if (setjmp(env) == 0) {
+        bench_exit_env = &env;
+        (mis_arr[index].func)(mis_arr, index);
+    }
+
+    bench_exit_env = NULL;
+
+    return;
+
+} // end of function call_menu_item_func()
+
+static void run_dispatch_batch(void *ctx)
+{
+
+    struct dispatch_ctx *dc = ctx;
+    struct menu_item *mis_arr = dc->mis_arr;
+    int i = 0;
+    int j = 0;
+
+    if (dc->input != NULL) {
+        dc->input->pos = 0;
+        bench_input = dc->input;
+    }
+
+    for (i = 0; i < BENCH_LINES_PER_BATCH; i++) {
+
+        if (dc->save_number == TM_TRUE) {
+            for (j = 0; j < TOTAL_NUMBER_OF_MENU_ITEMS; j++) {
+                mis_arr[j].arg = (void *)(1234L);
+            }
+        }
+
+        call_menu_item_func(mis_arr, dc->index);
+
+    } // end of for loop
+
+    return;
+
+} // end of function run_dispatch_batch()
+
+static void add_dispatch_benchmark(const char *name, int index,
+                                   const char *input_line, int save_number)
+{
+
+    struct dispatch_ctx *dc = xcalloc(1, sizeof(*dc));
+    double input_bytes_per_op = 0;
+
+    dc->mis_arr = xcalloc(TOTAL_NUMBER_OF_MENU_ITEMS, sizeof(*dc->mis_arr));
+    create_menu(dc->mis_arr);
+    dc->index = index;
+    dc->save_number = save_number;
+
+    if (input_line != NULL) {
+        dc->input = create_input(input_line, BENCH_LINES_PER_BATCH, NULL);
+        input_bytes_per_op = (double)(strlen(input_line));
+    }
+
+    add_benchmark(name, BENCH_LINES_PER_BATCH, input_bytes_per_op, dc,
+                  run_dispatch_batch);
+
+    return;
+
+} // end of function add_dispatch_benchmark()
+
+/*
+ * run_loop_batch():
+ *
+ *      Runs create_and_display_menu_and_process_user_input() on an input
+ *      that has BENCH_LOOP_ITERATIONS_PER_BATCH loop iterations followed by
+ *      BENCH_LOOP_EXIT_INPUT. The final iteration that exits is not counted
+ *      as an op, it is amortized over the other iterations.
+ */
+static void run_loop_batch(void *ctx)
+{
+
+    struct loop_ctx *lc = ctx;
+    jmp_buf env;
+
+    lc->input->pos = 0;
+    bench_input = lc->input;
+    bench_first_alloc = NULL;
+
+    if (setjmp(env) == 0) {
+        bench_exit_env = &env;
+        create_and_display_menu_and_process_user_input();
+    }
+
+    bench_exit_env = NULL;
+
+    if (bench_exit_status != 0) {
+        fprintf(stderr, "\n\nError: %s(): The menu loop exited with status %d."
+                " Exiting..\n\n", __FUNCTION__, bench_exit_status);
+        exit(1);
+    }
+
+    // The first allocation of the menu loop is its menu items array. The menu
+    // loop never frees it because it expects the program to exit.
+    if (bench_first_alloc == NULL) {
+        fprintf(stderr, "\n\nError: %s(): The menu loop didn't allocate the"
+                " menu items array. Exiting..\n\n", __FUNCTION__);
+        exit(1);
+    }
+
+    free(bench_first_alloc);
+    bench_first_alloc = NULL;
+
+    return;
+
+} // end of function run_loop_batch()
+
+static void add_loop_benchmark(const char *name, const char *iteration_input)
+{
+
+    struct loop_ctx *lc = xcalloc(1, sizeof(*lc));
+
+    lc->input = create_input(iteration_input,
+                             BENCH_LOOP_ITERATIONS_PER_BATCH,
+                             BENCH_LOOP_EXIT_INPUT);
+
+    add_benchmark(name, BENCH_LOOP_ITERATIONS_PER_BATCH,
+                  (double)(strlen(iteration_input)), lc, run_loop_batch);
+
+    return;
+
+} // end of function add_loop_benchmark()
+
+static void add_all_benchmarks(void)
+{
+
+    char *max_length_number = NULL;
+
+    add_input_benchmark("get_input/short_line", 1, OPTION_NUMBER_SIZE);
+    add_input_benchmark("get_input/long_line_discarded", 120,
+                        OPTION_NUMBER_SIZE);
+    add_input_benchmark("get_input/max_size_line", MAX_STR_SIZE_ALLOWED - 1,
+                        MAX_STR_SIZE_ALLOWED);
+
+    max_length_number = xcalloc(MAX_STR_SIZE_ALLOWED, 1);
+    memset(max_length_number, '7', MAX_STR_SIZE_ALLOWED - 1);
+
+    add_number_benchmark("is_str_a_number/1_digit_atoi", "3", TM_TRUE);
+    add_number_benchmark("is_str_a_number/4_digits_atoi", "1234", TM_TRUE);
+    add_number_benchmark("is_str_a_number/invalid", "12a4", TM_FALSE);
+    add_number_benchmark("is_str_a_number/max_length", max_length_number,
+                         TM_FALSE);
+
+    free(max_length_number);
+
+#define BENCH_ADD_PRINT_MENU_BENCHMARK(n)                                    \
+    add_print_menu_benchmark(n, BENCH_PASTE(bench_create_menu_, n),          \
+                             BENCH_PASTE(bench_print_menu_, n));
+
+    BENCH_FOR_EACH_MENU_SIZE(BENCH_ADD_PRINT_MENU_BENCHMARK)
+
+#undef BENCH_ADD_PRINT_MENU_BENCHMARK
+
+    add_dispatch_benchmark("func_dispatch/get_number_from_user", 0, "1234\n",
+                           TM_FALSE);
+    add_dispatch_benchmark("func_dispatch/show_saved_number", 1, NULL,
+                           TM_TRUE);
+    add_dispatch_benchmark("func_dispatch/show_sum_of_digits_of_number", 2,
+                           NULL, TM_TRUE);
+    add_dispatch_benchmark("func_dispatch/delete_saved_number", 3, NULL,
+                           TM_TRUE);
+    add_dispatch_benchmark("func_dispatch/exit_program", 4, NULL, TM_FALSE);
+
+    add_loop_benchmark("menu_loop/show_saved_number", "2\ny\n\n");
+    add_loop_benchmark("menu_loop/save_number", "1\ny\n1234\n\n");
+    add_loop_benchmark("menu_loop/cancel_selection", "3\nn\n\n");
+    add_loop_benchmark("menu_loop/invalid_option_then_valid",
+                       "abc\n0\n99999999\n2\ny\n\n");
+
+    return;
+
+} // end of function add_all_benchmarks()
+
+static long long time_batches(struct benchmark *b, long long num_batches)
+{
+
+    long long start = 0;
+    long long i = 0;
+
+    start = get_time_ns();
+
+    for (i = 0; i < num_batches; i++) {
+        b->run_batch(b->ctx);
+    }
+
+    return get_time_ns() - start;
+
+} // end of function time_batches()
+
+static int compare_doubles(const void *a, const void *b)
+{
+
+    double x = *((const double *)(a));
+    double y = *((const double *)(b));
+
+    return (x > y) - (x < y);
+
+} // end of function compare_doubles()
+
+static void run_benchmark(struct benchmark *b, long long min_time_ns,
+                          FILE *probe, FILE *devnull,
+                          struct bench_result *result)
+{
+
+    double ns_per_op[BENCH_REPETITIONS] = {0};
+    long long num_batches = 1;
+    long long elapsed = 0;
+    long long allocs = 0;
+    long long alloc_bytes = 0;
+    int i = 0;
+
+    // Run one batch with the output going to a file to find out how many bytes
+    // are written per op. This also warms up the caches.
+    rewind(probe);
+    bench_output = probe;
+    b->run_batch(b->ctx);
+    fflush(probe);
+    result->output_bytes_per_op = (double)(ftell(probe)) /
+                                  (double)(b->ops_per_batch);
+
+    bench_output = devnull;
+
+    // find the number of batches that take at least 'min_time_ns'
+    while (1) {
+
+        elapsed = time_batches(b, num_batches);
+
+        if (elapsed >= min_time_ns) {
+            break;
+        }
+
+        if (elapsed < (min_time_ns / 100)) {
+            num_batches = num_batches * 100;
+        } else {
+            num_batches = (long long)((double)(num_batches) * 1.2 *
+                                      (double)(min_time_ns) /
+                                      (double)(elapsed)) + 1;
+        }
+
+    } // end of while (1) loop
+
+    for (i = 0; i < BENCH_REPETITIONS; i++) {
+
+        bench_alloc_count = 0;
+        bench_alloc_bytes = 0;
+
+        elapsed = time_batches(b, num_batches);
+
+        ns_per_op[i] = (double)(elapsed) /
+                       (double)(num_batches * b->ops_per_batch);
+
+        allocs = bench_alloc_count;
+        alloc_bytes = bench_alloc_bytes;
+
+    } // end of for loop
+
+    qsort(ns_per_op, BENCH_REPETITIONS, sizeof(ns_per_op[0]), compare_doubles);
+
+    result->ops = num_batches * b->ops_per_batch;
+    result->ns_per_op = ns_per_op[BENCH_REPETITIONS / 2];
+    result->ops_per_sec = 1e9 / result->ns_per_op;
+    result->allocs_per_op = (double)(allocs) / (double)(result->ops);
+    result->alloc_bytes_per_op = (double)(alloc_bytes) / (double)(result->ops);
+
+    return;
+
+} // end of function run_benchmark()
+
+static void print_usage(const char *prog_name)
+{
+
+    fprintf(stderr, "Usage: %s [--filter <substring>] [--min-time-ms <ms>]"
+            " [--out <file>]\n", prog_name);
+    fprintf(stderr, "       <ms> must be in the range 1 - %d (default: %d)\n",
+            BENCH_MAX_MIN_TIME_MS, BENCH_DEFAULT_MIN_TIME_MS);
+
+    return;
+
+} // end of function print_usage()
+
+int main(int argc, char *argv[])
+{
+
+    struct bench_result *results = NULL;
+    struct benchmark *b = NULL;
+    struct bench_result *r = NULL;
+    const char *filter = NULL;
+    const char *out_file = BENCH_DEFAULT_OUT_FILE;
+    long min_time_ms = BENCH_DEFAULT_MIN_TIME_MS;
+    char *endptr = NULL;
+    FILE *probe = NULL;
+    FILE *devnull = NULL;
+    FILE *json = NULL;
+    char timestamp[32] = {0};
+    time_t now = 0;
+    struct tm tm_now = {0};
+    int first = TM_TRUE;
+    int i = 0;
+
+    for (i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "--filter") == 0) && ((i + 1) < argc)) {
+            i = i + 1;
+            filter = argv[i];
+        } else if ((strcmp(argv[i], "--min-time-ms") == 0) &&
+                   ((i + 1) < argc)) {
+            i = i + 1;
+            errno = 0;
+            min_time_ms = strtol(argv[i], &endptr, 10);
+            if ((errno != 0) || (endptr == argv[i]) || (*endptr != '\0') ||
+                (min_time_ms <= 0) || (min_time_ms > BENCH_MAX_MIN_TIME_MS)) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if ((strcmp(argv[i], "--out") == 0) && ((i + 1) < argc)) {
+            i = i + 1;
+            out_file = argv[i];
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    probe = tmpfile();
+    devnull = fopen("/dev/null", "w");
+
+    if ((probe == NULL) || (devnull == NULL)) {
+        fprintf(stderr, "\n\nError: %s(): Could not open the output streams"
+                " (%s). Exiting..\n\n", __FUNCTION__, strerror(errno));
+        if (probe != NULL) {
+            fclose(probe);
+        }
+        if (devnull != NULL) {
+            fclose(devnull);
+        }
+        return 1;
+    }
+
+    add_all_benchmarks();
+
+    results = xcalloc((size_t)(num_benchmarks), sizeof(*results));
+
+    printf("%-46s %12s %14s %10s %10s %10s\n", "benchmark", "ns/op", "ops/sec",
+           "in MB/s", "out MB/s", "allocs/op");
+
+    for (i = 0; i < num_benchmarks; i++) {
+
+        b = &benchmarks[i];
+        r = &results[i];
+
+        if ((filter != NULL) && (strstr(b->name, filter) == NULL)) {
+            continue;
+        }
+
+        run_benchmark(b, min_time_ms * 1000000LL, probe, devnull, r);
+
+        printf("%-46s %12.1f %14.0f %10.2f %10.2f %10.4f\n", b->name,
+               r->ns_per_op, r->ops_per_sec,
+               (b->input_bytes_per_op * r->ops_per_sec) / 1e6,
+               (r->output_bytes_per_op * r->ops_per_sec) / 1e6,
+               r->allocs_per_op);
+        fflush(stdout);
+
+    } // end of for loop
+
+    fclose(probe);
+    fclose(devnull);
+
+    json = fopen(out_file, "w");
+
+    if (json == NULL) {
+        fprintf(stderr, "\n\nError: %s(): Could not open \"%s\" (%s)."
+                " Exiting..\n\n", __FUNCTION__, out_file, strerror(errno));
+        free(results);
+        return 1;
+    }
+
+    now = time(NULL);
+    gmtime_r(&now, &tm_now);
+    strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", &tm_now);
+
+    fprintf(json, "{\n");
+    fprintf(json, "  \"timestamp\": \"%s\",\n", timestamp);
+#ifdef __VERSION__
+    fprintf(json, "  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+    fprintf(json, "  \"min_time_ms\": %ld,\n", min_time_ms);
+    fprintf(json, "  \"repetitions\": %d,\n", BENCH_REPETITIONS);
+    fprintf(json, "  \"benchmarks\": [");
+
+    for (i = 0; i < num_benchmarks; i++) {
+
+        b = &benchmarks[i];
+        r = &results[i];
+
+        if (r->ops == 0) { // filtered out
+            continue;
+        }
+
+        fprintf(json, "%s\n    {\n", (first == TM_TRUE) ? "" : ",");
+        fprintf(json, "      \"name\": \"%s\",\n", b->name);
+        fprintf(json, "      \"ops\": %lld,\n", r->ops);
+        fprintf(json, "      \"ns_per_op\": %.3f,\n", r->ns_per_op);
+        fprintf(json, "      \"ops_per_sec\": %.1f,\n", r->ops_per_sec);
+        fprintf(json, "      \"input_bytes_per_op\": %.3f,\n",
+                b->input_bytes_per_op);
+        fprintf(json, "      \"input_mb_per_sec\": %.3f,\n",
+                (b->input_bytes_per_op * r->ops_per_sec) / 1e6);
+        fprintf(json, "      \"output_bytes_per_op\": %.3f,\n",
+                r->output_bytes_per_op);
+        fprintf(json, "      \"output_mb_per_sec\": %.3f,\n",
+                (r->output_bytes_per_op * r->ops_per_sec) / 1e6);
+        fprintf(json, "      \"allocs_per_op\": %.6f,\n", r->allocs_per_op);
+        fprintf(json, "      \"alloc_bytes_per_op\": %.3f\n",
+                r->alloc_bytes_per_op);
+        fprintf(json, "    }");
+
+        first = TM_FALSE;
+
+    } // end of for loop
+
+    fprintf(json, "\n  ]\n}\n");
+
+    free(results);
+
+    if (fclose(json) != 0) {
+        fprintf(stderr, "\n\nError: %s(): Could not write \"%s\" (%s)."
+                " Exiting..\n\n", __FUNCTION__, out_file, strerror(errno));
+        return 1;
+    }
+
+    printf("\nResults written to \"%s\".\n", out_file);
+
+    return 0;
+
+} // end of function main()
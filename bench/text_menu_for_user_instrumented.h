@@ -0,0 +1,63 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Includes text_menu_for_user.c with its input, output, exit() and memory
+ * allocations redirected to the benchmark hooks declared in bench.h.
+ *
+ * Include this header only once per translation unit. If more than one
+ * translation unit includes it then each of them must define 'BENCH_MAIN_NAME'
+ * to a different name before including it (main() of text_menu_for_user.c is
+ * renamed to 'BENCH_MAIN_NAME').
+ */
+
+#ifndef TEXT_MENU_FOR_USER_INSTRUMENTED_H
+#define TEXT_MENU_FOR_USER_INSTRUMENTED_H
+
+#include "bench.h"
+
+#ifndef BENCH_MAIN_NAME
+#define BENCH_MAIN_NAME text_menu_for_user_main
+#endif
+
+#undef getchar
+#define getchar() bench_getchar()
+#define printf(...) fprintf(bench_output, __VA_ARGS__)
+#define exit(status) bench_exit(status)
+#define malloc(size) bench_malloc(size)
+#define calloc(nmemb, size) bench_calloc(nmemb, size)
+#define realloc(ptr, size) bench_realloc(ptr, size)
+#define free(ptr) bench_free(ptr)
+#define main BENCH_MAIN_NAME
+
+// A benchmark translation unit uses only some of the static functions of
+// text_menu_for_user.c.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+
+#include "../text_menu_for_user.c"
+
+#pragma GCC diagnostic pop
+
+#undef getchar
+#undef printf
+#undef exit
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+#undef main
+
+#endif // TEXT_MENU_FOR_USER_INSTRUMENTED_H
@@ -73,7 +73,19 @@
 
 // Menu starts with option number 1. Change the below value to the number of
 // menu items that you have.
+//
+// The #ifndef is a hook for the benchmark (see the 'bench' directory), which
+// gives this value on the compiler command line to build print_menu() for
+// several menu sizes. Don't use it to change the number of menu items of this
+// program, create_menu() must set up exactly this many menu items.
+#ifndef TOTAL_NUMBER_OF_MENU_ITEMS
 #define TOTAL_NUMBER_OF_MENU_ITEMS 5
+#endif
+
+// create_menu() sets up 5 menu items.
+#if TOTAL_NUMBER_OF_MENU_ITEMS < 5
+#error "TOTAL_NUMBER_OF_MENU_ITEMS must be at least 5 (see create_menu())"
+#endif
 
 // change this value according to your requirements
 #define MENU_ITEM_STRING_SIZE 1024 // including null terminating character